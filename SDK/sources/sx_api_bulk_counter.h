@@ -106,6 +106,9 @@ sx_status_t sx_api_bulk_counter_buffer_set(const sx_api_handle_t            hand
  *        4. Up to two transactions are allowed in parallel by the system:
  *           a. 2 x Port_Counters
  *           b. Any combination of two different bulk counter types
+ *           A route sampler enabled by sx_api_router_uc_route_sampler_set() holds the flow
+ *           counter transaction for as long as it is enabled, so flow counter transactions
+ *           return SX_STATUS_RESOURCE_IN_USE meanwhile.
  *  Supported devices: Spectrum, Spectrum2, Spectrum3.
  *
  * @param[in] handle      - SX-API handle
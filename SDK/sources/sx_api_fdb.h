@@ -163,6 +163,95 @@ sx_status_t sx_api_fdb_polling_interval_get(const sx_api_handle_t      handle,
                                             const sx_swid_t            swid,
                                             sx_fdb_polling_interval_t* interval);
 
+/**
+ *  This function creates/destroys an FDB notification ring for a switch partition.
+ *
+ *  While a ring exists, FDB notifications of the switch partition are driven by
+ *  the HW events instead of the polling interval. Learn, age and move
+ *  notifications are written, as soon as they are raised, as records into a ring
+ *  of ring_size records in memory shared between the SDK and the caller.
+ *  The returned file descriptor is level-triggered: it is readable for as long as
+ *  the ring is not empty, and may be used with poll/select/epoll. Reading only some
+ *  of the records leaves it readable.
+ *  Records are read by sx_api_fdb_notify_ring_get() without a call to the SDK.
+ *  Records of a switch partition are numbered consecutively from 1 at the creation
+ *  of the ring, dropped records included.
+ *  If the ring is full, new records are dropped, which shows as a gap in the
+ *  record numbers returned by sx_api_fdb_notify_ring_get().
+ *  sx_api_fdb_poll_set() or sx_api_fdb_uc_mac_addr_snapshot_get() may then be used
+ *  to resynchronize.
+ *  FDB notification events are still sent to host interface listeners as before.
+ *  Only one ring may exist per switch partition.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle     - SX-API handle
+ * @param[in] cmd        - CREATE/DESTROY
+ * @param[in] swid       - virtual switch partition ID
+ * @param[in] ring_size  - number of records in the ring. Ignored for DESTROY.
+ * @param[in,out] fd_p   - file descriptor of the ring. Returned on CREATE,
+ *                         given by the caller on DESTROY.
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ALREADY_INITIALIZED if a ring already exists for the switch partition
+ * @return SX_STATUS_NO_MEMORY if the ring cannot be allocated
+ * @return SX_STATUS_ENTRY_NOT_FOUND if no ring exists on DESTROY
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_notify_ring_set(const sx_api_handle_t handle,
+                                       const sx_access_cmd_t cmd,
+                                       const sx_swid_t       swid,
+                                       const uint32_t        ring_size,
+                                       sx_fd_t              *fd_p);
+
+/**
+ *  This function reads FDB notification records from a ring created by
+ *  sx_api_fdb_notify_ring_set(). Records are returned in the order in which the
+ *  notifications were raised, and are removed from the ring. The file descriptor
+ *  stops being readable only when this call leaves the ring empty.
+ *  This function does not block. If the ring is empty, *record_cnt_p is set to 0.
+ *  Record i is returned in entry i of each list:
+ *   - action_list_p: SX_ACCESS_CMD_ADD for a learn, SX_ACCESS_CMD_DELETE for an
+ *     age, SX_ACCESS_CMD_EDIT for a move.
+ *   - mac_list_p: the UC MAC entry {MAC, FID, log port, entry type, action}, as set
+ *     in hardware for learn and move, and as it was before removal for age.
+ *   - old_log_port_list_p: for a move, the log port the MAC moved from.
+ *     Not set for learn and age.
+ *   - seq_num_list_p: the number of the record (see sx_api_fdb_notify_ring_set()).
+ *     A gap between consecutive numbers means that records were dropped.
+ *     Numbers allow the records to be matched with an FDB snapshot taken by
+ *     sx_api_fdb_uc_mac_addr_snapshot_get().
+ *
+ *  When in 802.1D mode, bridge_id's are returned in mac_list_p->fid_vid.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] fd_p                  - file descriptor of the ring
+ * @param[out] action_list_p        - notification type of each record
+ * @param[out] mac_list_p           - MAC entry of each record
+ * @param[out] old_log_port_list_p  - previous log port of each move record
+ * @param[out] seq_num_list_p       - number of each record
+ * @param[in,out] record_cnt_p      - [in] size of the lists; [out] number of records read
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR if fd_p is not an FDB notification ring
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_notify_ring_get(const sx_api_handle_t        handle,
+                                       const sx_fd_t               *fd_p,
+                                       sx_access_cmd_t             *action_list_p,
+                                       sx_fdb_uc_mac_addr_params_t *mac_list_p,
+                                       sx_port_log_id_t            *old_log_port_list_p,
+                                       uint64_t                    *seq_num_list_p,
+                                       uint32_t                    *record_cnt_p);
+
 
 /**
  *  This function adds/deletes UC MAC and UC LAG MAC entries to/from the FDB.
@@ -270,6 +359,57 @@ sx_status_t sx_api_fdb_uc_mac_addr_get(const sx_api_handle_t              handle
                                        sx_fdb_uc_mac_addr_params_t       *mac_list_p,
                                        uint32_t                          *data_cnt_p);
 
+/**
+ * This function copies all the UC MAC entries of a switch partition that match
+ * mac_type and key_filter_p into a caller supplied buffer, as they are at a single
+ * point in time. Unlike sx_api_fdb_uc_mac_addr_get, the number of entries is
+ * limited only by the size of the buffer, and entries learned, aged or moved
+ * during the call do not make the copy inconsistent.
+ * The buffer may be any memory owned by the caller, including a memory mapped file.
+ *
+ * *seq_num_p returns the sequence number of the first FDB notification record
+ * raised after the snapshot (see sx_api_fdb_notify_ring_get()). The snapshot plus
+ * every record from that number on give the exact current state of the FDB.
+ * Record numbers restart from 1 each time a ring is created, so a number is only
+ * meaningful for the ring that exists when the snapshot is taken. If the ring is
+ * destroyed and created again, a new snapshot must be taken.
+ * If no notification ring exists for the switch partition, the snapshot is still
+ * returned and *seq_num_p is set to 0.
+ *
+ * If *data_cnt_p is 0, only the number of matching entries is returned.
+ * If *data_cnt_p is smaller than the number of matching entries, no entries are
+ * returned, and *data_cnt_p is set to the number of matching entries.
+ *
+ *  When in 802.1D mode, bridge_id's will be stored in mac_list_p->fid_vid, and
+ *  key_filter_p->fid should be a bridge_id.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle         - SX-API handle
+ * @param[in] swid           - virtual switch partition ID
+ * @param[in] mac_type       - static, dynamic, all
+ * @param[in] key_filter_p   - filter types used on the mac_list_p - FID/MAC/logical port (may be NULL)
+ * @param[out] mac_list_p    - buffer of MAC entries
+ * @param[in,out] data_cnt_p - [in] size of the buffer in entries;
+ *                             [out] number of entries returned
+ * @param[out] seq_num_p     - notification sequence number of the snapshot, or 0
+ *                             if no notification ring exists
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_NO_MEMORY if the buffer is too small for the matching entries
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_mac_addr_snapshot_get(const sx_api_handle_t            handle,
+                                                const sx_swid_t                  swid,
+                                                const sx_fdb_uc_mac_entry_type_t mac_type,
+                                                const sx_fdb_uc_key_filter_t    *key_filter_p,
+                                                sx_fdb_uc_mac_addr_params_t     *mac_list_p,
+                                                uint32_t                        *data_cnt_p,
+                                                uint64_t                        *seq_num_p);
+
 /**
  * This function counts all MAC entries in the SW FDB table (static and dynamic).
  *
@@ -334,6 +474,50 @@ sx_status_t sx_api_fdb_uc_fid_count_get(const sx_api_handle_t handle,
                                         const sx_fid_t        fid,
                                         uint32_t             *data_cnt_p);
 
+/**
+ * This function retrieves the number of MACs learned (static and dynamic) on every
+ * port and on every FID of a switch partition in one call.
+ * The counts are kept up to date by the SDK as entries are added and removed, so
+ * the cost of this function does not depend on the size of the FDB.
+ * Only ports and FIDs with at least one MAC are returned; the count of any other
+ * port or FID is 0. Entry i of port_count_list_p is the count of log_port_list_p[i],
+ * and entry i of fid_count_list_p is the count of fid_list_p[i].
+ * If *port_cnt_p (*fid_cnt_p) is 0, only the number of ports (FIDs) with MACs
+ * is returned.
+ * If *port_cnt_p or *fid_cnt_p is not 0 but smaller than the number of ports or
+ * FIDs with MACs, no entries are returned in any of the lists, *port_cnt_p and
+ * *fid_cnt_p are set to the number of ports and FIDs with MACs, and
+ * SX_STATUS_NO_MEMORY is returned. Both counts are taken at the same point in time.
+ *
+ *  When in 802.1D mode, bridge_id's are returned in fid_list_p.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] swid                - virtual switch partition ID
+ * @param[out] log_port_list_p    - list of logical port IDs
+ * @param[out] port_count_list_p  - number of MACs of each port
+ * @param[in,out] port_cnt_p      - [in] size of the port lists; [out] number of ports returned
+ * @param[out] fid_list_p         - list of filtering DB IDs
+ * @param[out] fid_count_list_p   - number of MACs of each FID
+ * @param[in,out] fid_cnt_p       - [in] size of the FID lists; [out] number of FIDs returned
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE for an invalid handle
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if the SWID is out of range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_NO_MEMORY if a list is too small for the ports or FIDs with MACs
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_count_bulk_get(const sx_api_handle_t handle,
+                                         const sx_swid_t       swid,
+                                         sx_port_log_id_t     *log_port_list_p,
+                                         uint32_t             *port_count_list_p,
+                                         uint32_t             *port_cnt_p,
+                                         sx_fid_t             *fid_list_p,
+                                         uint32_t             *fid_count_list_p,
+                                         uint32_t             *fid_cnt_p);
+
 /**
  * This function sets/removes the limit on the amount of dynamic MACs learned on a port.
  *
@@ -878,6 +1062,83 @@ sx_status_t sx_api_fdb_mc_flush_fid_set(const sx_api_handle_t handle,
 sx_status_t sx_api_fdb_flush_by_type_set(const sx_api_handle_t  handle,
                                          const sx_flush_data_t *flush_data_p);
 
+/**
+ *  This function starts a background flush of dynamic UC FDB table entries and
+ *  returns immediately with the ID of the flush job.
+ *
+ *  The entries flushed are those learned on one of the FIDs in fid_list_p and on
+ *  one of the ports in log_port_list_p. If fid_cnt is 0, entries of all FIDs are
+ *  flushed; if port_cnt is 0, entries of all ports are flushed. fid_cnt and
+ *  port_cnt cannot both be 0 (SX_STATUS_PARAM_ERROR).
+ *  Only entries that exist when the job starts are flushed. The SDK stamps every
+ *  learned entry with a learn generation, and the job records the current
+ *  generation when it starts. An entry learned, or moved, after the job started
+ *  has a newer generation and is never deleted by the job, even if it matches the
+ *  FIDs and ports of the job. A port that comes back up while a job is still
+ *  flushing it thus keeps the MACs it learns again.
+ *  The job deletes at most rate_limit entries per second, so that large flushes
+ *  do not delay other FDB operations; a rate_limit of 0 means no limit.
+ *  Up to 16 jobs may be in progress per switch partition. Completed jobs do not
+ *  take a place, even while their state is still kept.
+ *  When the job completes, an SX_TRAP_ID_FDB_FLUSH_DONE event holding the job ID
+ *  and the number of flushed entries is sent to the listeners of this trap.
+ *  The state of a job may also be read by sx_api_fdb_uc_flush_job_get().
+ *
+ *  When in 802.1D mode, instead of providing fids (filtering IDs),
+ *  you should provide bridge_ids.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] swid             - virtual switch partition ID
+ * @param[in] fid_list_p       - list of filtering DB IDs (may be NULL if fid_cnt is 0)
+ * @param[in] fid_cnt          - number of FIDs in fid_list_p
+ * @param[in] log_port_list_p  - list of logical ports (may be NULL if port_cnt is 0)
+ * @param[in] port_cnt         - number of ports in log_port_list_p
+ * @param[in] rate_limit       - maximum number of entries deleted per second
+ * @param[out] job_id_p        - ID of the flush job
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_PARAM_ERROR if a parameter is invalid, or fid_cnt and port_cnt are both 0
+ * @return SX_STATUS_NO_RESOURCES if 16 jobs are already in progress on the switch partition
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_flush_async_set(const sx_api_handle_t   handle,
+                                          const sx_swid_t         swid,
+                                          const sx_fid_t         *fid_list_p,
+                                          const uint32_t          fid_cnt,
+                                          const sx_port_log_id_t *log_port_list_p,
+                                          const uint32_t          port_cnt,
+                                          const uint32_t          rate_limit,
+                                          uint32_t               *job_id_p);
+
+/**
+ *  This function retrieves the state of a flush job started by
+ *  sx_api_fdb_uc_flush_async_set().
+ *  The state of a job is kept for 60 seconds after the job completes, and
+ *  SX_STATUS_ENTRY_NOT_FOUND is returned for it afterwards.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle           - SX-API handle
+ * @param[in] job_id           - ID of the flush job
+ * @param[out] done_p          - whether the job has completed
+ * @param[out] flushed_cnt_p   - number of entries flushed so far
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the job is not found
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_uc_flush_job_get(const sx_api_handle_t handle,
+                                        const uint32_t        job_id,
+                                        boolean_t            *done_p,
+                                        uint32_t             *flushed_cnt_p);
+
 
 /**
  *  This function maps VLANs to filtering databases for shared
@@ -1119,6 +1380,87 @@ sx_status_t sx_api_fdb_notify_params_get(const sx_api_handle_t   handle,
                                          const sx_swid_t         swid,
                                          sx_fdb_notify_params_t *notify_params_p);
 
+/**
+ *  This function enables/disables MAC flap detection on a switch partition.
+ *
+ *  A MAC is flapping when it moves between ports more than move_threshold times
+ *  within interval_msec. While a MAC is flapping, no move notification events are
+ *  sent for it. Instead, one SX_TRAP_ID_FDB_MAC_FLAP event per flapping MAC is sent
+ *  at the end of every interval to the listeners of this trap. The event holds:
+ *   - the MAC key {MAC, FID};
+ *   - the number of moves of the MAC in the interval;
+ *   - the distinct log ports the MAC was learned on in the interval, in the order
+ *     in which they were first seen, up to 8 ports, and a truncated flag set when
+ *     the MAC was learned on more than 8 ports;
+ *   - the log port it was last learned on;
+ *   - the flap state: started, continuing or stopped;
+ *   - whether the MAC is quarantined.
+ *  The MAC stops flapping after an interval with no more than move_threshold moves.
+ *  A last event with state stopped is then sent, and move notifications resume.
+ *  Records written to an FDB notification ring (see sx_api_fdb_notify_ring_set())
+ *  are coalesced only if coalesce_ring is TRUE. The ring then receives, for each
+ *  flapping MAC, one move record per interval for the last move of the interval,
+ *  with the old log port set to the port the MAC was on when the interval began.
+ *  The moves in between are not numbered, so they do not show as dropped records,
+ *  and a snapshot plus the ring still give the exact current state of the FDB.
+ *  If coalesce_ring is FALSE, every move is written to the ring.
+ *  If quarantine is TRUE, a flapping MAC is also installed as a static entry on
+ *  the port it was last learned on, which stops further moves. The entry is kept
+ *  until it is deleted by sx_api_fdb_uc_mac_addr_set, or flap detection is disabled.
+ *  Flapping MACs are retrieved by sx_api_fdb_flap_mac_get().
+ *  Calling ENABLE again changes the parameters.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - ENABLE/DISABLE
+ * @param[in] swid            - virtual switch partition ID
+ * @param[in] move_threshold  - number of moves per interval above which a MAC is flapping
+ * @param[in] interval_msec   - detection interval in milliseconds (min 100)
+ * @param[in] quarantine      - install flapping MACs as static entries
+ * @param[in] coalesce_ring   - coalesce the moves of flapping MACs in the notification ring
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_CMD_UNSUPPORTED if command is not supported
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_flap_detect_set(const sx_api_handle_t handle,
+                                       const sx_access_cmd_t cmd,
+                                       const sx_swid_t       swid,
+                                       const uint32_t        move_threshold,
+                                       const uint32_t        interval_msec,
+                                       const boolean_t       quarantine,
+                                       const boolean_t       coalesce_ring);
+
+/**
+ *  This function retrieves the MACs that are currently flapping on a switch
+ *  partition, as detected by sx_api_fdb_flap_detect_set(), with the number of
+ *  moves of each MAC in the last interval.
+ *  If *mac_cnt_p is 0, only the number of flapping MACs is returned.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] swid                - virtual switch partition ID
+ * @param[out] mac_key_list_p     - list of flapping MACs {MAC, FID}
+ * @param[out] move_cnt_list_p    - number of moves of each MAC in the last interval
+ * @param[in,out] mac_cnt_p       - [in] size of the lists; [out] number of MACs returned
+ *
+ * @return SX_STATUS_SUCCESS if the operation completes successfully
+ * @return SX_STATUS_INVALID_HANDLE if a NULL handle is received
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if a parameter exceeds its range
+ * @return SX_STATUS_PARAM_NULL if any parameters are NULL
+ * @return SX_STATUS_ENTRY_NOT_FOUND if flap detection is not enabled
+ * @return SX_STATUS_ERROR for a general error
+ */
+sx_status_t sx_api_fdb_flap_mac_get(const sx_api_handle_t handle,
+                                    const sx_swid_t       swid,
+                                    sx_fdb_mac_key_t     *mac_key_list_p,
+                                    uint32_t             *move_cnt_list_p,
+                                    uint32_t             *mac_cnt_p);
+
 /**
  * This function is used to block ports from flooding a selected FID.
  *
@@ -169,6 +169,12 @@ sx_status_t sx_api_rm_entries_duplication_get(const sx_api_handle_t
  * This API gets the utilization of a logical resource in the SDK. User is
  * responsible for memory management of the retrieved utilization list.
  *
+ * For the unicast route table types, the utilization counts the routes written
+ * to hardware. When FIB compression is enabled on a virtual router (see
+ * sx_api_router_uc_route_compression_set), routes suppressed by compression are
+ * not counted. The number of routes set by the user is given by
+ * sx_api_router_uc_route_compression_get.
+ *
  * Supported devices: Spectrum, Spectrum2, Spectrum3.
  *
  * @param[in] handle   - SX-API handle
@@ -193,6 +199,10 @@ sx_status_t sx_api_rm_sdk_table_utilization_get(const sx_api_handle_t          h
 /**
  * This API retrieves the utilization of a HW Table in the SDK.
  *
+ * When host route placement is enabled (see sx_api_router_uc_route_host_offload_set),
+ * the utilization of the host table includes the host routes placed in it, and the
+ * utilization of the LPM table includes only the host routes that did not fit.
+ *
  * Supported devices: Spectrum, Spectrum2, Spectrum3.
  *
  * @param[in] handle   - SX-API handle
@@ -193,6 +193,47 @@ sx_status_t sx_api_router_init_set(const sx_api_handle_t              handle,
  */
 sx_status_t sx_api_router_deinit_set(const sx_api_handle_t handle);
 
+/**
+ *  This function enables/disables a read cache of router objects for an SX-API handle.
+ *  While the cache is enabled, the following calls made with the handle are
+ *  answered from memory of the calling process when the requested object is cached,
+ *  without a call to the SDK:
+ *   - sx_api_router_interface_get
+ *   - sx_api_router_ecmp_get
+ *   - sx_api_router_uc_route_get with cmd GET and *uc_route_get_entries_cnt_p = 1
+ *  An object is cached when it is returned by one of these calls, or set through
+ *  the handle. Invalidation does not depend on the caching processes:
+ *  the SDK keeps generation counters for router objects in a shared memory
+ *  region that every caching handle maps read-only. A change of an object, made
+ *  through any handle, increments the counter of the object before the change
+ *  completes. This is a local write by the SDK, so changes never wait for
+ *  caching processes. Each cached object holds the counter value it was read
+ *  with, and a get answers from the cache only if the counter has not changed
+ *  since; otherwise the object is read from the SDK and cached again.
+ *  The SDK also keeps a route generation counter per virtual router, in the same
+ *  region. Changes that replace routes of a virtual router without a per-route
+ *  change, such as sx_api_router_swap_set or sx_api_router_uc_route_set with
+ *  DELETE_ALL, increment it. A cached route holds the value of both counters, and
+ *  is used only if neither has changed.
+ *  A get never returns a value older than the last completed change.
+ *  Operational values, such as those returned by sx_api_router_operational_ecmp_get,
+ *  are never cached.
+ *  DISABLE drops all cached objects of the handle.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd    - ENABLE/DISABLE.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_NO_MEMORY if the cache cannot be allocated.
+ * @return SX_STATUS_MODULE_UNINITIALIZED if router module is uninitialized.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_cache_set(const sx_api_handle_t handle,
+                                    const sx_access_cmd_t cmd);
+
 /**
  *  This function adds/deletes/edits a virtual router.
  *  The router ID is allocated and returned to the caller when
@@ -276,6 +317,63 @@ sx_status_t sx_api_router_vrid_iter_get(const sx_api_handle_t   handle,
                                         sx_router_id_t         *vrid_list_p,
                                         uint32_t               *vrid_cnt_p);
 
+/**
+ *  This function atomically replaces the routing table of a virtual router by
+ *  the routing table of a shadow virtual router.
+ *  The shadow virtual router is an ordinary virtual router created by
+ *  sx_api_router_set with ADD, which has no router interfaces. Its unicast and
+ *  multicast routes are built off the data path, with the usual route APIs, and
+ *  may point to ECMP containers, next hops and router interfaces of vrid.
+ *  The swap changes the hardware mapping of the router interfaces of vrid from
+ *  the routing table of vrid to the routing table of shadow_vrid in a single
+ *  hardware commit, so every packet is routed either by the old routes or by the
+ *  new routes. After the swap, vrid holds the new routes and keeps its router
+ *  interfaces and attributes, and shadow_vrid holds the old routes.
+ *  Neighbors belong to the router interfaces of vrid, but their host table
+ *  entries are keyed by the hardware routing table. Before the commit, the SDK
+ *  therefore writes a copy of every neighbor of vrid to the host table under the
+ *  routing table of shadow_vrid, so directly connected hosts keep forwarding
+ *  across the swap. Neighbor changes made during the swap are written to both
+ *  copies. Host routes placed in the host table (see
+ *  sx_api_router_uc_route_host_offload_set) belong to their routing table and
+ *  move with it.
+ *  FIB compression state (see sx_api_router_uc_route_compression_set) belongs to
+ *  the routing table as well and is exchanged with it: after the swap, vrid has
+ *  the compression state and counts of the new routes. The route sampler (see
+ *  sx_api_router_uc_route_sampler_set) must be disabled on both virtual routers
+ *  for the swap, and may be enabled again on vrid afterwards.
+ *  The swap increments the route generation counters of vrid and shadow_vrid
+ *  before the commit completes, so routes cached by sx_api_router_cache_set are
+ *  never returned from before the swap.
+ *  If delete_old is TRUE, the old routes are deleted in the background after the
+ *  swap, and shadow_vrid is then deleted. sx_api_router_get returns
+ *  SX_STATUS_ENTRY_NOT_FOUND for shadow_vrid as soon as this function returns.
+ *  Otherwise shadow_vrid keeps the old routes, so a further swap reverts to them.
+ *  The neighbor copies under the old routing table are deleted with it when
+ *  delete_old is TRUE, and are otherwise kept up to date for a further swap.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle      - SX-API handle.
+ * @param[in] vrid        - Virtual Router ID whose routing table is replaced.
+ * @param[in] shadow_vrid - Virtual Router ID holding the new routing table.
+ * @param[in] delete_old  - delete the old routes and shadow_vrid after the swap.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_PARAM_ERROR if vrid and shadow_vrid are the same router.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if a router was not added.
+ * @return SX_STATUS_RESOURCE_IN_USE if shadow_vrid has router interfaces, or a
+ *         route sampler is enabled on one of the virtual routers.
+ * @return SX_STATUS_NO_RESOURCES if there is no room in the host table for the
+ *         neighbors of vrid under the new routing table.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_swap_set(const sx_api_handle_t handle,
+                                   const sx_router_id_t  vrid,
+                                   const sx_router_id_t  shadow_vrid,
+                                   const boolean_t       delete_old);
+
 
 /**
  *  This function adds/modifies/deletes/delete_all a router
@@ -559,6 +657,49 @@ sx_status_t sx_api_router_neigh_set(const sx_api_handle_t       handle,
                                     const sx_ip_addr_t         *ip_addr_p,
                                     const sx_neigh_data_t      *neigh_data_p);
 
+/**
+ *  This function adds/deletes a batch of neighbors in one API call.
+ *  Entry i of the batch is described by rif_list_p[i], ip_addr_list_p[i] and
+ *  neigh_data_list_p[i], and is handled exactly as sx_api_router_neigh_set()
+ *  handles a single neighbor with the same cmd.
+ *  A failure of one entry does not abort the batch. The result of entry i is
+ *  returned in status_list_p[i], and the remaining entries are still applied.
+ *  The maximum value of neigh_cnt is 4096.
+ *
+ *  When cmd is ADD and ecmp_first is TRUE, neighbors which resolve a next hop of
+ *  an existing ECMP container are written to hardware before the rest of the
+ *  batch. Routes through those containers then forward traffic as early as
+ *  possible. Otherwise neighbors are written in the order in which they appear
+ *  in the batch.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle            - SX-API handle.
+ * @param[in] cmd               - ADD/DELETE.
+ * @param[in] rif_list_p        - list of Router Interface IDs
+ * @param[in] ip_addr_list_p    - list of neighbor IP addresses
+ * @param[in] neigh_data_list_p - list of neighbors information. Ignored for DELETE.
+ * @param[in] ecmp_first        - install neighbors used by ECMP containers first
+ * @param[out] status_list_p    - per-neighbor operation status
+ * @param[in] neigh_cnt         - number of neighbors in each of the lists
+ *
+ * @return SX_STATUS_SUCCESS if all neighbors completed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if one or more neighbors failed; see status_list_p.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if neigh_cnt exceeds range.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_neigh_bulk_set(const sx_api_handle_t        handle,
+                                         const sx_access_cmd_t        cmd,
+                                         const sx_router_interface_t *rif_list_p,
+                                         const sx_ip_addr_t          *ip_addr_list_p,
+                                         const sx_neigh_data_t       *neigh_data_list_p,
+                                         const boolean_t              ecmp_first,
+                                         sx_status_t                 *status_list_p,
+                                         const uint32_t               neigh_cnt);
+
 /**
  *  This function gets the neighbor's information.
  *
@@ -628,6 +769,67 @@ sx_status_t sx_api_router_neigh_activity_get(const sx_api_handle_t       handle,
                                              const sx_ip_addr_t         *ip_addr_p,
                                              boolean_t                  *activity_p);
 
+/**
+ *  This function reads and cleans the activity of all neighbors of a router
+ *  interface or of a virtual router in one API call. Only the active neighbors
+ *  are returned, so the cost of the call depends on the number of active
+ *  neighbors and not on the size of the neighbor table.
+ *
+ *  Neighbors of all router interfaces of vrid are scanned if rif is
+ *  rm_resource_global.router_rifs_dontcare; otherwise only neighbors of rif
+ *  are scanned, and vrid must be the virtual router of rif.
+ *  Only neighbors whose IP version matches version are scanned. If version is
+ *  SX_IP_VERSION_NONE, only IPv4 neighbors are scanned.
+ *
+ *  Neighbors are scanned in the order of {rif, IP address}. If start_ip_addr_p is
+ *  NULL, the scan starts from the first neighbor and start_rif is ignored.
+ *  Otherwise it starts from the neighbor that follows {start_rif, *start_ip_addr_p},
+ *  as with GETNEXT in sx_api_router_neigh_get; that neighbor does not have to exist
+ *  any more.
+ *  The RIF of active_neigh_list_p[i] is returned in active_rif_list_p[i]. The rif in
+ *  the neighbor data is not used by this function.
+ *  If *active_neigh_cnt_p is 0, the number of active neighbors is returned and
+ *  no activity is cleared.
+ *  If there are more active neighbors than *active_neigh_cnt_p, the scan stops
+ *  once the buffer is full, and with READ_CLEAR only the activity of the returned
+ *  neighbors is cleared. To continue, call again with start_rif and start_ip_addr_p
+ *  set to the RIF and IP address of the last neighbor returned. This works the same
+ *  for READ and READ_CLEAR.
+ *  The sweep is complete when fewer neighbors than requested are returned.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                 - SX-API handle.
+ * @param[in] cmd                    - READ / READ_CLEAR
+ * @param[in] vrid                   - Virtual Router ID.
+ * @param[in] rif                    - Router Interface Id, or don't care for the whole virtual router.
+ * @param[in] version                - IP version of the neighbors to scan
+ * @param[in] start_rif              - RIF of the scan position, as described above.
+ * @param[in] start_ip_addr_p        - IP address of the scan position (may be NULL).
+ * @param[out] active_rif_list_p     - RIF of each active neighbor
+ * @param[out] active_neigh_list_p   - list of active neighbors
+ * @param[in,out] active_neigh_cnt_p - [in] size of the lists;
+ *                                     [out] number of active neighbors returned
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the router or router interface was not found.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_neigh_activity_bulk_get(const sx_api_handle_t       handle,
+                                                  const sx_access_cmd_t       cmd,
+                                                  const sx_router_id_t        vrid,
+                                                  const sx_router_interface_t rif,
+                                                  const sx_ip_version_t       version,
+                                                  const sx_router_interface_t start_rif,
+                                                  const sx_ip_addr_t         *start_ip_addr_p,
+                                                  sx_router_interface_t      *active_rif_list_p,
+                                                  sx_neigh_get_entry_t       *active_neigh_list_p,
+                                                  uint32_t                   *active_neigh_cnt_p);
+
 /**
  *  This function modifies unicast routes in the routing table.
  *  A route may have one of several types: IP2ME, LOCAL, or NEXT_HOP
@@ -664,7 +866,8 @@ sx_status_t sx_api_router_neigh_activity_get(const sx_api_handle_t       handle,
  * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
  * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
  * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
- * @return SX_STATUS_NO_RESOURCES if no routes is available to create.
+ * @return SX_STATUS_NO_RESOURCES if no routes is available to create, or if the
+ *         completion queue of the handle is full in Async Mode.
  * @return SX_STATUS_ERROR general error.
  */
 sx_status_t sx_api_router_uc_route_set(const sx_api_handle_t handle,
@@ -673,6 +876,48 @@ sx_status_t sx_api_router_uc_route_set(const sx_api_handle_t handle,
                                        const sx_ip_prefix_t *network_addr,
                                        sx_uc_route_data_t   *uc_route_data_p);
 
+/**
+ *  This function modifies a batch of unicast routes in the routing table of a
+ *  single virtual router in one API call.
+ *  Entry i of the batch is described by cmd_list_p[i], network_addr_list_p[i] and
+ *  uc_route_data_list_p[i], and is handled exactly as sx_api_router_uc_route_set()
+ *  handles a single route with the same cmd, network address and route data.
+ *  Entries are applied in the order in which they appear in the batch, so a route
+ *  may be added and later modified or deleted by the same call.
+ *  A failure of one entry does not abort the batch. The result of entry i is
+ *  returned in status_list_p[i], and the remaining entries are still applied.
+ *  The maximum value of route_cnt is 4096.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *  Note: This API supports Async Mode operation if the router is initialized
+ *  with Async support. In Async Mode, status_list_p[i] is SX_STATUS_ACCEPTED for
+ *  each entry that was queued for hardware.
+ *
+ * @param[in] handle                   - SX-API handle.
+ * @param[in] cmd_list_p               - list of commands, one per route: ADD/SET/SOFT_ADD/DELETE
+ * @param[in] vrid                     - Virtual Router ID.
+ * @param[in] network_addr_list_p      - list of IP network addresses
+ * @param[in,out] uc_route_data_list_p - list of route data {ecmp id,action}.
+ *                                       Ignored for DELETE entries.
+ * @param[out] status_list_p           - per-route operation status
+ * @param[in] route_cnt                - number of routes in each of the lists
+ *
+ * @return SX_STATUS_SUCCESS if all routes completed successfully.
+ * @return SX_STATUS_ACCEPTED if all routes were accepted in Async Mode.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if one or more routes failed; see status_list_p.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if route_cnt exceeds range.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_bulk_set(const sx_api_handle_t  handle,
+                                            const sx_access_cmd_t *cmd_list_p,
+                                            const sx_router_id_t   vrid,
+                                            const sx_ip_prefix_t  *network_addr_list_p,
+                                            sx_uc_route_data_t    *uc_route_data_list_p,
+                                            sx_status_t           *status_list_p,
+                                            const uint32_t         route_cnt);
+
 /**
  *  This function gets unicast route information from the routing table.
  *  The function can receive four types of input:
@@ -724,6 +969,183 @@ sx_status_t sx_api_router_uc_route_get(const sx_api_handle_t     handle,
                                        sx_uc_route_get_entry_t  *uc_route_get_entries_list_p,
                                        uint32_t                 *uc_route_get_entries_cnt_p);
 
+/**
+ *  This function dumps the unicast routes of a virtual router into a caller
+ *  supplied buffer. Unlike sx_api_router_uc_route_get, the number of routes
+ *  returned per call is limited only by the size of the buffer, so a whole
+ *  routing table may be retrieved in a few calls.
+ *  The buffer may be any memory owned by the caller, including a shared memory
+ *  region. Routes are copied into it directly, without intermediate per-route
+ *  processing.
+ *
+ *   - 1) cmd SX_ACCESS_CMD_GET_FIRST,
+ *        dump routes from the start of the table. The IP version to dump is
+ *        taken from cursor_p->version. If the version is SX_IP_VERSION_NONE, IPv4
+ *        routes are dumped.
+ *
+ *   - 2) cmd SX_ACCESS_CMD_GETNEXT,
+ *        continue the dump from the route that follows cursor_p. cursor_p should be
+ *        the value returned by the previous call.
+ *
+ *  On return, cursor_p holds the last route copied into uc_route_get_entries_list_p.
+ *  A dump is complete when fewer routes than requested are returned.
+ *  Routes are visited in the same order as by sx_api_router_uc_route_get, so routes
+ *  added or deleted during the dump behave as they do with GET_FIRST/GETNEXT.
+ *  If *uc_route_get_entries_cnt_p is 0, only the number of routes that match
+ *  filter_p is returned.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                         - SX-API handle.
+ * @param[in] cmd                            - GET_FIRST/GETNEXT.
+ * @param[in] vrid                           - Virtual Router ID.
+ * @param[in] filter_p                       - UC route key_filter (may be NULL).
+ * @param[in,out] cursor_p                   - dump position, as described above
+ * @param[out] uc_route_get_entries_list_p   - buffer of found uc route entries.
+ * @param[in,out] uc_route_get_entries_cnt_p - [in] size of the buffer in entries;
+ *                                             [out] number of entries returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the virtual router was not found.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_dump_get(const sx_api_handle_t           handle,
+                                            const sx_access_cmd_t           cmd,
+                                            const sx_router_id_t            vrid,
+                                            const sx_uc_route_key_filter_t *filter_p,
+                                            sx_ip_prefix_t                 *cursor_p,
+                                            sx_uc_route_get_entry_t        *uc_route_get_entries_list_p,
+                                            uint32_t                       *uc_route_get_entries_cnt_p);
+
+/**
+ *  This function enables/disables FIB compression of the unicast routes of a
+ *  virtual router.
+ *  While compression is enabled, a route is not written to hardware if the
+ *  longest less specific route that covers it has the same route data (type,
+ *  action, ECMP container or next hop, trap priority and priority). Traffic to
+ *  the route is then forwarded by the covering route, with the same result.
+ *  Compression only suppresses routes that are redundant with a covering route.
+ *  It does not create aggregate routes, so routes that have the same route data
+ *  but no common covering route (for example two sibling /25 routes without a
+ *  /24) are all written to hardware, and the installed set is not necessarily
+ *  the smallest one that gives the same forwarding.
+ *  The suppression of each route is updated as routes are added, modified and
+ *  deleted, so a route change writes to hardware only the routes whose
+ *  installation actually changes.
+ *  Compression does not change the routes returned by sx_api_router_uc_route_get
+ *  and sx_api_router_uc_route_dump_get, which always return the routes as set
+ *  by the user.
+ *  Routes with a flow counter bound to them by the user are always written to
+ *  hardware. Counters bound by the route sampler do not count for this.
+ *  On ENABLE, existing routes are compressed. On DISABLE, all suppressed routes
+ *  are written to hardware before the function returns.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd    - ENABLE/DISABLE.
+ * @param[in] vrid   - Virtual Router ID.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if router was not added.
+ * @return SX_STATUS_NO_RESOURCES if there is no room to write the suppressed routes on DISABLE.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_compression_set(const sx_api_handle_t handle,
+                                                   const sx_access_cmd_t cmd,
+                                                   const sx_router_id_t  vrid);
+
+/**
+ *  This function gets the FIB compression state of a virtual router, and the
+ *  number of its unicast routes as set by the user (logical) and as written to
+ *  hardware (installed) for the IP version given in version.
+ *  When compression is disabled, both counts are equal.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle             - SX-API handle.
+ * @param[in] vrid               - Virtual Router ID.
+ * @param[in] version            - IP version of the routes to count.
+ * @param[out] enabled_p         - whether compression is enabled.
+ * @param[out] logical_cnt_p     - number of routes set by the user.
+ * @param[out] installed_cnt_p   - number of routes written to hardware.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if router was not added.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_compression_get(const sx_api_handle_t handle,
+                                                   const sx_router_id_t  vrid,
+                                                   const sx_ip_version_t version,
+                                                   boolean_t            *enabled_p,
+                                                   uint32_t             *logical_cnt_p,
+                                                   uint32_t             *installed_cnt_p);
+
+/**
+ *  This function enables/disables placement of host routes in the host table.
+ *  While enabled, IPv4 /32 and IPv6 /128 unicast routes are written to the exact
+ *  match host table used by sx_api_router_neigh_set instead of the LPM table.
+ *  When the host table is full, further host routes are written to the LPM table,
+ *  and they are moved to the host table in the background as room becomes
+ *  available. Neighbors take precedence: when a neighbor cannot be added because
+ *  the host table is full, host routes are moved back to the LPM table to make
+ *  room for it.
+ *  A host route whose address is the IP address of a neighbor in the same
+ *  virtual router would use the same host table key as that neighbor, so it is
+ *  always kept in the LPM table. When such a neighbor is added, the host route is
+ *  moved to the LPM table before the neighbor is written, and it is moved back to
+ *  the host table after the neighbor is deleted. Host table lookups then behave
+ *  as they do with placement disabled.
+ *  The placement of a route does not change its forwarding, nor the way it is
+ *  returned by sx_api_router_uc_route_get.
+ *  On DISABLE, all host routes are moved back to the LPM table before the
+ *  function returns.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle - SX-API handle.
+ * @param[in] cmd    - ENABLE/DISABLE.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_NO_RESOURCES if there is no room in the LPM table on DISABLE.
+ * @return SX_STATUS_MODULE_UNINITIALIZED if router module is uninitialized.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_host_offload_set(const sx_api_handle_t handle,
+                                                    const sx_access_cmd_t cmd);
+
+/**
+ *  This function gets the host route placement state, and the number of host
+ *  routes of the given IP version currently placed in the host table and in
+ *  the LPM table.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle          - SX-API handle.
+ * @param[in] version         - IP version of the routes to count.
+ * @param[out] enabled_p      - whether host route placement is enabled.
+ * @param[out] host_cnt_p     - number of host routes in the host table.
+ * @param[out] lpm_cnt_p      - number of host routes in the LPM table.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_host_offload_get(const sx_api_handle_t handle,
+                                                    const sx_ip_version_t version,
+                                                    boolean_t            *enabled_p,
+                                                    uint32_t             *host_cnt_p,
+                                                    uint32_t             *lpm_cnt_p);
+
 /**
  * \deprecated This API is deprecated and will be removed in the future. Use ECMP containers.
  * This function retrieves active unicast ECMP route information from the routing table.
@@ -770,6 +1192,47 @@ sx_status_t sx_api_router_uc_route_counter_bind_set(const sx_api_handle_t      h
                                                     const sx_ip_prefix_t      *network_addr_p,
                                                     const sx_flow_counter_id_t counter_id);
 
+/**
+ *  Binds or un-binds flow counters to a batch of existing unicast routes in one API call.
+ *  Route i of the batch is given by vrid_list_p[i] and network_addr_list_p[i], and
+ *  is handled exactly as sx_api_router_uc_route_counter_bind_set() handles a single
+ *  route with the same cmd.
+ *  For BIND, the counter of route i is counter_id_list_p[i]. If counter_id_list_p is
+ *  NULL, the counter of route i is base_counter_id + i, so a range of counters created
+ *  by sx_api_flow_counter_bulk_set() may be bound without listing its IDs.
+ *  A failure of one route does not abort the batch. The result of route i is
+ *  returned in status_list_p[i], and the remaining routes are still handled.
+ *  The maximum value of route_cnt is 4096.
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle              - SX-API handle
+ * @param[in] cmd                 - BIND/UNBIND
+ * @param[in] vrid_list_p         - list of Virtual Router IDs
+ * @param[in] network_addr_list_p - list of network prefixes of unicast routes
+ * @param[in] counter_id_list_p   - list of flow counter identifiers (may be NULL).
+ *                                  Applicable only for command BIND
+ * @param[in] base_counter_id     - first flow counter identifier, used when
+ *                                  counter_id_list_p is NULL. Applicable only for command BIND
+ * @param[out] status_list_p      - per-route operation status
+ * @param[in] route_cnt           - number of routes in each of the lists
+ *
+ * @return SX_STATUS_SUCCESS if all routes completed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if one or more routes failed; see status_list_p.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_counter_bind_bulk_set(const sx_api_handle_t       handle,
+                                                         const sx_access_cmd_t       cmd,
+                                                         const sx_router_id_t       *vrid_list_p,
+                                                         const sx_ip_prefix_t       *network_addr_list_p,
+                                                         const sx_flow_counter_id_t *counter_id_list_p,
+                                                         const sx_flow_counter_id_t  base_counter_id,
+                                                         sx_status_t                *status_list_p,
+                                                         const uint32_t              route_cnt);
+
 /**
  *  Retrieves the flow counter currently bound to a specified unicast route
  *  Notes: A flow counter may be bound to a route via a call to sx_api_router_uc_route_counter_bind_set()
@@ -793,6 +1256,89 @@ sx_status_t sx_api_router_uc_route_counter_bind_get(const sx_api_handle_t handle
                                                     const sx_ip_prefix_t *network_addr_p,
                                                     sx_flow_counter_id_t *counter_id_p);
 
+/**
+ *  Enables or disables traffic sampling of the unicast routes of a virtual router.
+ *  The sampler shares a fixed pool of flow counters among all the routes of the
+ *  virtual router. Every dwell_time_msec the counters are read with a single
+ *  bulk counter transaction and then bound to the next group of routes, until
+ *  every route has been sampled, and then the rotation starts over.
+ *  For every route the SDK keeps the packet and byte rates measured while it was
+ *  last sampled. sx_api_router_uc_route_sampler_get() returns them.
+ *  Notes: The pool must be a range of flow counters of type packets and bytes
+ *         created by sx_api_flow_counter_bulk_set(). The counters must not be bound
+ *         when the sampler is enabled, and are owned by the sampler until it is
+ *         disabled.
+ *         Routes which have a flow counter bound by the user are not sampled.
+ *         Routes suppressed by FIB compression (see
+ *         sx_api_router_uc_route_compression_set) are not written to hardware and
+ *         are not sampled; their traffic is counted by the covering route. Binding a
+ *         sampler counter does not cause a route to be written to hardware.
+ *         While enabled, the sampler holds the flow counter bulk counter transaction
+ *         (see sx_api_bulk_counter_transaction_set). Only one transaction of each type
+ *         may be in flight, so user flow counter bulk reads return
+ *         SX_STATUS_RESOURCE_IN_USE until the sampler is disabled, and only one port
+ *         counter transaction can run alongside the sampler.
+ *         For the same reason, only one virtual router may have a sampler enabled at
+ *         a time. ENABLE returns SX_STATUS_RESOURCE_IN_USE if a sampler is enabled on
+ *         another virtual router, or if a flow counter bulk transaction is in flight.
+ *         A full rotation takes dwell_time_msec * (number of routes / counter_cnt).
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle          - SX-API handle
+ * @param[in] cmd             - ENABLE/DISABLE
+ * @param[in] vrid            - Virtual Router ID
+ * @param[in] base_counter_id - first flow counter of the pool. Applicable only for command ENABLE
+ * @param[in] counter_cnt     - number of flow counters in the pool. Applicable only for command ENABLE
+ * @param[in] dwell_time_msec - time each route is sampled, in milliseconds (min 100).
+ *                              Applicable only for command ENABLE
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the router or a flow counter was not found.
+ * @return SX_STATUS_RESOURCE_IN_USE if a flow counter of the pool is bound, a sampler
+ *         is already enabled on this or another virtual router, or a flow counter
+ *         bulk transaction is in flight.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_sampler_set(const sx_api_handle_t      handle,
+                                               const sx_access_cmd_t      cmd,
+                                               const sx_router_id_t       vrid,
+                                               const sx_flow_counter_id_t base_counter_id,
+                                               const uint32_t             counter_cnt,
+                                               const uint32_t             dwell_time_msec);
+
+/**
+ *  Retrieves the routes with the highest sampled traffic rates of a virtual router.
+ *  Routes are returned in descending order of byte rate. Rates are given per
+ *  second, and extrapolated from the last time each route was sampled by the
+ *  sampler enabled with sx_api_router_uc_route_sampler_set().
+ *  Routes which were not sampled yet are not returned.
+ *  If *route_cnt_p is 0, only the number of sampled routes is returned.
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle               - SX-API handle
+ * @param[in] vrid                 - Virtual Router ID
+ * @param[out] network_addr_list_p - network prefixes of the returned routes
+ * @param[out] packet_rate_list_p  - packets per second of the returned routes
+ * @param[out] byte_rate_list_p    - bytes per second of the returned routes
+ * @param[in,out] route_cnt_p      - [in] number of routes to get;
+ *                                   [out] number of routes returned
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if the sampler is not enabled on the virtual router.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_uc_route_sampler_get(const sx_api_handle_t handle,
+                                               const sx_router_id_t  vrid,
+                                               sx_ip_prefix_t       *network_addr_list_p,
+                                               uint64_t             *packet_rate_list_p,
+                                               uint64_t             *byte_rate_list_p,
+                                               uint32_t             *route_cnt_p);
+
 /**
  * This function creates/destroys a router counter. A router counter
  * should be bound later to a router interface.
@@ -983,6 +1529,47 @@ sx_status_t sx_api_router_mc_route_set(const sx_api_handle_t            handle,
                                        const sx_mc_route_attributes_t * mc_route_attr_p,
                                        const sx_mc_route_data_t       * mc_route_data_p);
 
+/**
+ * This function adds/modifies/deletes a batch of multicast routes of a single
+ * virtual router in one API call.
+ * Entry i of the batch is described by cmd_list_p[i], mc_route_key_list_p[i],
+ * mc_route_attr_list_p[i] and mc_route_data_list_p[i], and is handled exactly as
+ * sx_api_router_mc_route_set() handles a single route with the same parameters.
+ * In particular, the RPF group of the route (created by sx_api_router_mc_rpf_group_set)
+ * is given in its attributes, and its egress RIFs or egress container in its data.
+ * Entries are applied in the order in which they appear in the batch.
+ * A failure of one entry does not abort the batch. The result of entry i is
+ * returned in status_list_p[i], and the remaining entries are still applied.
+ * The maximum value of route_cnt is 4096.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle               - SX-API handle.
+ * @param[in] cmd_list_p           - list of commands, one per route: ADD/EDIT/DELETE
+ * @param[in] vrid                 - Virtual Router ID.
+ * @param[in] mc_route_key_list_p  - list of mc route entry keys
+ *                                   {source IP prefix, group mask, ingress RIF}
+ * @param[in] mc_route_attr_list_p - list of multicast route attributes. Ignored for DELETE entries.
+ * @param[in] mc_route_data_list_p - list of route data. Ignored for DELETE entries.
+ * @param[out] status_list_p       - per-route operation status
+ * @param[in] route_cnt            - number of routes in each of the lists
+ *
+ * @return SX_STATUS_SUCCESS if all routes completed successfully.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if one or more routes failed; see status_list_p.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if route_cnt exceeds range.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_bulk_set(const sx_api_handle_t           handle,
+                                            const sx_access_cmd_t          *cmd_list_p,
+                                            const sx_router_id_t            vrid,
+                                            const sx_mc_route_key_t        *mc_route_key_list_p,
+                                            const sx_mc_route_attributes_t *mc_route_attr_list_p,
+                                            const sx_mc_route_data_t       *mc_route_data_list_p,
+                                            sx_status_t                    *status_list_p,
+                                            const uint32_t                  route_cnt);
+
 /**
  * This function gets a multicast route or routes from the MC routing table,
  * based on a given key or criteria.
@@ -1038,6 +1625,83 @@ sx_status_t sx_api_router_mc_route_get(const sx_api_handle_t     handle,
                                        sx_mc_route_get_entry_t  *mc_route_get_entries_list_p,
                                        uint32_t                 *mc_route_get_entries_cnt_p);
 
+/**
+ * This function gets a batch of multicast routes of a single virtual router,
+ * given by their keys, in one API call.
+ * Entry i of mc_route_get_entries_list_p returns the route whose key is
+ * mc_route_key_list_p[i], including its attributes, its RPF group and its egress
+ * RIFs or egress container, as returned by sx_api_router_mc_route_get with GET.
+ * The result of entry i is returned in status_list_p[i]. If the route is not
+ * found, status_list_p[i] is SX_STATUS_ENTRY_NOT_FOUND and the other entries are
+ * still returned.
+ * The maximum value of route_cnt is 4096.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                       - SX-API handle.
+ * @param[in] vrid                         - Virtual Router ID.
+ * @param[in] mc_route_key_list_p          - list of mc route entry keys
+ *                                           {Source IP Address, group address, ingress rif}
+ * @param[out] mc_route_get_entries_list_p - list of returned MC routes
+ * @param[out] status_list_p               - per-route operation status
+ * @param[in] route_cnt                    - number of routes in each of the lists
+ *
+ * @return SX_STATUS_SUCCESS if all routes were found.
+ * @return SX_STATUS_PARTIALLY_COMPLETE if one or more routes were not returned; see status_list_p.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_bulk_get(const sx_api_handle_t    handle,
+                                            const sx_router_id_t     vrid,
+                                            const sx_mc_route_key_t *mc_route_key_list_p,
+                                            sx_mc_route_get_entry_t *mc_route_get_entries_list_p,
+                                            sx_status_t             *status_list_p,
+                                            const uint32_t           route_cnt);
+
+/**
+ * This function dumps the multicast routes of a virtual router into a caller
+ * supplied buffer. Unlike sx_api_router_mc_route_get, the number of routes
+ * returned per call is not limited by SX_API_MC_ROUTE_GET_MAX_COUNT, only by the
+ * size of the buffer, so a whole MC routing table may be retrieved in a few calls.
+ *
+ *   - 1) cmd SX_ACCESS_CMD_GET_FIRST,
+ *        dump routes from the start of the table. cursor_p is ignored on input.
+ *
+ *   - 2) cmd SX_ACCESS_CMD_GETNEXT,
+ *        continue the dump from the route that follows cursor_p. cursor_p should be
+ *        the value returned by the previous call.
+ *
+ * On return, cursor_p holds the key of the last route copied into
+ * mc_route_get_entries_list_p. A dump is complete when fewer routes than
+ * requested are returned.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                         - SX-API handle.
+ * @param[in] cmd                            - GET_FIRST/GETNEXT.
+ * @param[in] vrid                           - Virtual Router ID.
+ * @param[in] filter_p                       - filter according to which MC routes should be
+ *                                             returned (may be NULL).
+ * @param[in,out] cursor_p                   - dump position, as described above
+ * @param[out] mc_route_get_entries_list_p   - buffer of returned MC routes
+ * @param[in,out] mc_route_get_entries_cnt_p - [in] size of the buffer in entries;
+ *                                             [out] number of entries returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_dump_get(const sx_api_handle_t           handle,
+                                            const sx_access_cmd_t           cmd,
+                                            const sx_router_id_t            vrid,
+                                            const sx_mc_route_key_filter_t *filter_p,
+                                            sx_mc_route_key_t              *cursor_p,
+                                            sx_mc_route_get_entry_t        *mc_route_get_entries_list_p,
+                                            uint32_t                       *mc_route_get_entries_cnt_p);
+
 /**
  * This function reads and clears multicast route activity.
  * Supported devices: Spectrum, Spectrum2, Spectrum3.
@@ -1060,6 +1724,50 @@ sx_status_t sx_api_router_mc_route_activity_get(const sx_api_handle_t    handle,
                                                 const sx_router_id_t     vrid,
                                                 const sx_mc_route_key_t *mc_route_key_p,
                                                 boolean_t               *activity_p);
+
+/**
+ * This function reads and clears the activity of all multicast routes of a
+ * virtual router in one API call. Only the keys of the active routes are
+ * returned, so the cost of the call depends on the number of active routes and
+ * not on the size of the MC routing table.
+ * Only routes whose IP version matches version are scanned. If version is
+ * SX_IP_VERSION_NONE, routes of all IP versions are scanned.
+ * If *active_route_cnt_p is 0, the number of active routes is returned and no
+ * activity is cleared.
+ * Routes are scanned in the same order as by sx_api_router_mc_route_dump_get.
+ * If start_key_p is NULL, the scan starts from the first route. Otherwise it
+ * starts from the route that follows start_key_p; that route does not have to
+ * exist any more.
+ * If there are more active routes than *active_route_cnt_p, the scan stops once
+ * the buffer is full, and with READ_CLEAR only the activity of the returned
+ * routes is cleared. To continue, call again with start_key_p pointing to the
+ * last key returned. This works the same for READ and READ_CLEAR.
+ * The sweep is complete when fewer routes than requested are returned.
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                   - SX-API handle.
+ * @param[in] cmd                      - READ\READ_CLEAR
+ * @param[in] vrid                     - Virtual Router ID.
+ * @param[in] version                  - IP version of the routes to scan
+ * @param[in] start_key_p              - scan position, as described above (may be NULL).
+ * @param[out] active_route_key_list_p - keys of the active mc routes
+ *                                       {Source IP Address, group address, ingress rif}
+ * @param[in,out] active_route_cnt_p   - [in] size of active_route_key_list_p;
+ *                                       [out] number of active routes returned
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_mc_route_activity_bulk_get(const sx_api_handle_t    handle,
+                                                     const sx_access_cmd_t    cmd,
+                                                     const sx_router_id_t     vrid,
+                                                     const sx_ip_version_t    version,
+                                                     const sx_mc_route_key_t *start_key_p,
+                                                     sx_mc_route_key_t       *active_route_key_list_p,
+                                                     uint32_t                *active_route_cnt_p);
 /**
  * This function initiates a notification regarding active mc routes in the system.
  *  Supported devices: Spectrum, Spectrum2, Spectrum3.
@@ -1260,6 +1968,21 @@ sx_status_t sx_api_router_cos_dscp_to_prio_get(const sx_api_handle_t    handle,
  * and new container ID.
  * SX_ACCESS_CMD_SET - Modifies the contents of an existing ECMP container,
  * specified by *ecmp_id_p. If *next_hop_cnt_p is zero, SET cmd empties the container.
+ * SX_ACCESS_CMD_ADD - Adds the given next hops to an existing ECMP container,
+ * specified by *ecmp_id_p. A given next hop whose key is already in the container
+ * with the same weight is left as it is; with a different weight, its weight is
+ * changed to the given one.
+ * SX_ACCESS_CMD_DELETE - Deletes the given next hops from an existing ECMP container,
+ * specified by *ecmp_id_p. Other next hops in the container are left as they are.
+ * Only the key of each given next hop is used. If a given key is not in the
+ * container, nothing is deleted and SX_STATUS_ENTRY_NOT_FOUND is returned.
+ * A DELETE that would remove all the next hops of a container in use by UC
+ * route(s) is refused like clearing with SET: nothing is deleted and
+ * SX_STATUS_RESOURCE_IN_USE is returned.
+ * ADD and DELETE apply either all of the given next hops or none of them.
+ * They do not write to next_hop_list_p, and on return *next_hop_cnt_p holds the
+ * number of next hops in the container. The resulting container can be read with
+ * sx_api_router_ecmp_get or sx_api_router_operational_ecmp_get.
  * SX_ACCESS_CMD_DESTROY - by providing a container ID, the command removes
  * all next hops from the existing given container, destroying the container as well.
  * The container ID is invalid until reassigned on container creation. This command
@@ -1290,22 +2013,36 @@ sx_status_t sx_api_router_cos_dscp_to_prio_get(const sx_api_handle_t    handle,
  *        - next hop #B with weight of 2;
  *      you will get unbalanced ECMP container.
  *      In the HW, this ECMP container will have three next hops with total weight of four: nh #A, nh #B, nh #A.
+ *      To get a closer split, enable the balanced layout on the container with
+ *      sx_api_router_ecmp_balanced_layout_set.
+ *
+ * Note for ECMP containers of type SX_ECMP_TYPE_RESILIENT_E (see sx_api_router_ecmp_attributes_set):
+ *   1. ADD assigns to the new next hops only buckets taken from other next hops
+ *      in proportion to their surplus weight. Other buckets keep their next hop.
+ *   2. DELETE, and a next hop becoming unresolved, reassign only the buckets of
+ *      the removed next hop, spread over the remaining next hops by weight.
+ *      Flows hashed to the buckets of remaining next hops are not moved.
+ *   3. SET with a list that differs from the current one by a few next hops
+ *      behaves as the matching sequence of DELETE and ADD.
  *
  * Supported devices: Spectrum, Spectrum2, Spectrum3.
  *
  * @param[in] handle                 - SX-API handle
- * @param[in] cmd                    - action to perform: CREATE, DESTROY, SET,
+ * @param[in] cmd                    - action to perform: CREATE, DESTROY, SET, ADD, DELETE
  * @param[in,out] ecmp_id            - id of ECMP container
- * @param[in,out] next_hop_list_p    - a given list of next hops
- * @param[in,out] next_hop_cnt_p     - amount of next hops
+ * @param[in,out] next_hop_list_p    - a given list of next hops. Not written for ADD/DELETE.
+ * @param[in,out] next_hop_cnt_p     - amount of next hops. For ADD/DELETE, [in] number of
+ *                                     given next hops; [out] number of next hops in the container.
  *
  * @return SX_STATUS_SUCCESS             if operation completes successfully.
  * @return SX_STATUS_PARAM_ERROR         if parameter is NULL or exceeds range.
  * @return SX_STATUS_UNSUPPORTED         if invalid cmd.
  * @return SX_STATUS_NO_RESOURCES        if no space for ECMP container allocation.
  * @return SX_STATUS_RESOURCE_IN_USE     if trying to destroy ECMP an container
- *                                       in use.
- * @return SX_STATUS_ENTRY_NOT_FOUND     if ecmp_id not found.
+ *                                       in use, or for DELETE if it would empty a
+ *                                       container in use by UC route(s).
+ * @return SX_STATUS_ENTRY_NOT_FOUND     if ecmp_id not found, or for DELETE if
+ *                                       a next hop is not in the container.
  * @return SX_STATUS_ERROR               general error.
  */
 sx_status_t sx_api_router_ecmp_set(const sx_api_handle_t handle,
@@ -1314,6 +2051,65 @@ sx_status_t sx_api_router_ecmp_set(const sx_api_handle_t handle,
                                    sx_next_hop_t        *next_hop_list_p,
                                    uint32_t             *next_hop_cnt_p);
 
+/**
+ * This function gets/releases a shared ECMP container for a set of next hops.
+ *
+ * SX_ACCESS_CMD_CREATE - The SDK hashes the given next hops (keys and weights,
+ * regardless of their order). If a shared container with the same set already
+ * exists, its ID is returned and its reference count is incremented. Otherwise a
+ * new shared container is created, as by sx_api_router_ecmp_set with CREATE, and
+ * its ID is returned with a reference count of 1.
+ * SX_ACCESS_CMD_DESTROY - Decrements the reference count of the shared container
+ * specified by *ecmp_id_p. The container is destroyed when the count drops to 0.
+ * next_hop_list_p and next_hop_cnt_p are ignored.
+ *
+ * Notes:
+ *   1. Only containers created by this function are shared. Containers created by
+ *      sx_api_router_ecmp_set are never returned by this function.
+ *   2. The contents and attributes of a shared container cannot be changed.
+ *      sx_api_router_ecmp_set with SET/ADD/DELETE/DESTROY and
+ *      sx_api_router_ecmp_attributes_set return SX_STATUS_RESOURCE_IN_USE for it.
+ *      Next hop resolution changes, and sx_api_router_next_hop_replace_set, are
+ *      still applied, as for any container.
+ *   3. Shared containers are indexed by their configured set of next hops.
+ *      Resolution changes do not change the configured set and leave the index
+ *      as it is. When sx_api_router_next_hop_replace_set changes the set of a
+ *      shared container, the container is re-indexed under its new set in the same
+ *      call, so CREATE with the old set no longer returns it.
+ *      If another shared container already has the new set, that container stays
+ *      in the index and is returned by later CREATE calls. The re-keyed container
+ *      is removed from the index: it keeps working for its current references and
+ *      is destroyed when its reference count drops to 0, but is never returned by
+ *      CREATE again.
+ *   4. Shared containers always have the default attributes (type
+ *      SX_ECMP_TYPE_STATIC_E), so they are never resilient. Callers that need a
+ *      resilient container should create it with sx_api_router_ecmp_set.
+ *   5. sx_api_object_refcount_get reports the references taken by this function
+ *      together with the references of the objects that point to the container.
+ *   6. A shared container takes one ECMP entry in the utilization reported by
+ *      sx_api_rm_sdk_table_utilization_get, however many references it has.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                 - SX-API handle
+ * @param[in] cmd                    - CREATE/DESTROY
+ * @param[in,out] ecmp_id_p          - id of the shared ECMP container
+ * @param[in] next_hop_list_p        - a given list of next hops
+ * @param[in] next_hop_cnt           - amount of next hops
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_PARAM_ERROR         if parameter is NULL or exceeds range.
+ * @return SX_STATUS_UNSUPPORTED         if invalid cmd.
+ * @return SX_STATUS_NO_RESOURCES        if no space for ECMP container allocation.
+ * @return SX_STATUS_ENTRY_NOT_FOUND     if ecmp_id not found or is not a shared container.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_ecmp_shared_set(const sx_api_handle_t handle,
+                                          const sx_access_cmd_t cmd,
+                                          sx_ecmp_id_t         *ecmp_id_p,
+                                          const sx_next_hop_t  *next_hop_list_p,
+                                          const uint32_t        next_hop_cnt);
+
 /**
  * This function retrieves an ECMP container content, as defined by the user.
  * Note:
@@ -1426,6 +2222,66 @@ sx_status_t sx_api_router_operational_ecmp_get(const sx_api_handle_t handle,
                                                sx_next_hop_t        *next_hop_list_p,
                                                uint32_t             *next_hop_cnt_p);
 
+/**
+ *  This function retrieves the content of many ECMP containers, as written to HW,
+ *  in one API call. For each container, the next hops are those that
+ *  sx_api_router_operational_ecmp_get returns for it.
+ *  The next hops of all returned containers are packed one after the other into
+ *  next_hop_list_p: the next hops of ecmp_list_p[0] come first, followed by the
+ *  next hops of ecmp_list_p[1], and so on. next_hop_cnt_list_p[i] holds the number
+ *  of next hops of ecmp_list_p[i].
+ *  Containers are returned in order until ecmp_list_p is full, there are no more
+ *  containers, or the next hops of the next container do not fit in what is left
+ *  of next_hop_list_p. A container is never skipped or returned in part.
+ *  If the next hops of the first container to return do not fit in the whole of
+ *  next_hop_list_p, no container is returned, *next_hop_cnt_p is set to the number
+ *  of next hops of that container, and SX_STATUS_NO_MEMORY is returned.
+ *  The call may then be repeated with the same ecmp_id_key and a larger buffer.
+ *
+ *   - 1) cmd SX_ACCESS_CMD_GET_FIRST,
+ *        get containers from the start of the ECMP container DB. ecmp_id_key is ignored.
+ *
+ *   - 2) cmd SX_ACCESS_CMD_GETNEXT,
+ *        get containers which come after ecmp_id_key (the container does not have to exist).
+ *
+ *  Containers are visited in the same order as by sx_api_router_ecmp_iter_get.
+ *  *more_p is set to TRUE if there are containers after the last container
+ *  returned, and to FALSE when the iteration is complete. To continue, call
+ *  GETNEXT with ecmp_id_key set to the last container returned.
+ *  The ECMP container used by a UC route is returned in its route data by
+ *  sx_api_router_uc_route_get and sx_api_router_uc_route_dump_get.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                - SX-API handle
+ * @param[in] cmd                   - GET_FIRST/GETNEXT
+ * @param[in] ecmp_id_key           - ECMP container ID to continue after
+ * @param[out] ecmp_list_p          - list of returned ECMP container IDs
+ * @param[out] next_hop_cnt_list_p  - number of next hops of each returned container
+ * @param[in,out] ecmp_cnt_p        - [in] size of ecmp_list_p and next_hop_cnt_list_p;
+ *                                    [out] number of containers returned
+ * @param[out] next_hop_list_p      - packed next hops of the returned containers
+ * @param[in,out] next_hop_cnt_p    - [in] size of next_hop_list_p;
+ *                                    [out] number of next hops returned, or needed
+ *                                    by the next container as described above
+ * @param[out] more_p               - TRUE if more containers remain to be read
+ *
+ * @return SX_STATUS_SUCCESS             if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED     if access command isn't supported.
+ * @return SX_STATUS_PARAM_ERROR         if parameter is NULL or exceeds range.
+ * @return SX_STATUS_NO_MEMORY           if next_hop_list_p cannot hold the next container.
+ * @return SX_STATUS_ERROR               general error.
+ */
+sx_status_t sx_api_router_operational_ecmp_bulk_get(const sx_api_handle_t handle,
+                                                    const sx_access_cmd_t cmd,
+                                                    const sx_ecmp_id_t    ecmp_id_key,
+                                                    sx_ecmp_id_t         *ecmp_list_p,
+                                                    uint32_t             *next_hop_cnt_list_p,
+                                                    uint32_t             *ecmp_cnt_p,
+                                                    sx_next_hop_t        *next_hop_list_p,
+                                                    uint32_t             *next_hop_cnt_p,
+                                                    boolean_t            *more_p);
+
 
 /**
  *  This function binds/unbinds a router counter to a list of next hops for a
@@ -1540,6 +2396,66 @@ sx_status_t sx_api_router_ecmp_attributes_get(const sx_api_handle_t handle,
                                               const sx_ecmp_id_t    ecmp_id,
                                               sx_ecmp_attributes_t *attr_p);
 
+/**
+ * This function enables/disables the balanced layout of an ECMP container.
+ * The balanced layout changes how the HW entries of a weighted container are
+ * distributed when the HW size of the container is different from the total
+ * weight of its next hops. Containers without it keep the default layout
+ * described in sx_api_router_ecmp_set.
+ *
+ * With the balanced layout:
+ *   1. The share of a next hop is size * weight / total weight, and its relative
+ *      error is |entries - share| / share. Every next hop with a non-zero weight
+ *      gets at least one entry, as long as the size is not smaller than the number
+ *      of such next hops. Among the splits that meet this rule, the SDK uses one
+ *      with the smallest maximum relative error over all next hops. If there are
+ *      several, it uses the one with the smallest second largest error, and so on.
+ *      Any tie left is broken in favor of the next hop that appears first in the
+ *      container, which gets the extra entry.
+ *      For example, for weights 1:2 in 4 entries the split is A,B,B,B (nh #A 25%
+ *      below, nh #B 12.5% above its share), and for weights 2:23 in 5 entries it is
+ *      1:4.
+ *   2. When next hops are added, deleted or change weight, the new distribution is
+ *      computed in the same way, and entries are moved only from next hops that
+ *      have more entries than in the new distribution to next hops that have fewer.
+ *      No more entries are rewritten than needed to reach the new distribution.
+ * On ENABLE and DISABLE, the entries of the container are redistributed in the
+ * same way. Shared containers (see sx_api_router_ecmp_shared_set) always use the
+ * default layout.
+ *
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle      - SX-API handle
+ * @param[in] cmd         - ENABLE/DISABLE
+ * @param[in] ecmp_id     - an ID of an ECMP container
+ *
+ * @return SX_STATUS_SUCCESS              if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED      if access command isn't supported.
+ * @return SX_STATUS_ENTRY_NOT_FOUND      if ecmp_id not found.
+ * @return SX_STATUS_RESOURCE_IN_USE      if ecmp_id is a shared container.
+ * @return SX_STATUS_ERROR                general error
+ */
+sx_status_t sx_api_router_ecmp_balanced_layout_set(const sx_api_handle_t handle,
+                                                   const sx_access_cmd_t cmd,
+                                                   const sx_ecmp_id_t    ecmp_id);
+
+/**
+ * This function retrieves whether the balanced layout is enabled on an ECMP container.
+ * Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle      - SX-API handle.
+ * @param[in] ecmp_id     - id of ECMP container.
+ * @param[out] enabled_p  - whether the balanced layout is enabled
+ *
+ * @return SX_STATUS_SUCCESS           if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL        if parameter is NULL.
+ * @return SX_STATUS_ENTRY_NOT_FOUND   if ecmp_id not found.
+ * @return SX_STATUS_ERROR             general error
+ */
+sx_status_t sx_api_router_ecmp_balanced_layout_get(const sx_api_handle_t handle,
+                                                   const sx_ecmp_id_t    ecmp_id,
+                                                   boolean_t            *enabled_p);
+
 /**
  * This function clones an ECMP container.
  * Note:
@@ -1736,6 +2652,106 @@ sx_status_t sx_api_router_ecmp_redirect_get(const sx_api_handle_t handle,
                                             boolean_t            *is_redirected_p,
                                             sx_ecmp_id_t         *redirected_ecmp_p);
 
+/**
+ *  This API returns the unicast routes that point to a given ECMP container.
+ *  The SDK keeps an index from every ECMP container to the routes that use it,
+ *  so the cost of this API depends on the number of routes returned and not on
+ *  the size of the routing tables.
+ *
+ *   - 1) cmd SX_ACCESS_CMD_GET_FIRST,
+ *        get the first n routes that point to ecmp_id. vrid_key and
+ *        network_addr_key_p are ignored.
+ *
+ *   - 2) cmd SX_ACCESS_CMD_GETNEXT,
+ *        get the next n routes that point to ecmp_id, after the route given by
+ *        vrid_key and network_addr_key_p (the route does not have to exist).
+ *
+ *  If *route_cnt_p is 0, only the number of routes that point to ecmp_id is returned.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle               - SX-API handle.
+ * @param[in] cmd                  - GET_FIRST/GETNEXT.
+ * @param[in] ecmp_id              - ECMP container ID.
+ * @param[in] vrid_key             - Virtual Router ID of the key route.
+ * @param[in] network_addr_key_p   - IP network address of the key route.
+ * @param[out] vrid_list_p         - Virtual Router IDs of the returned routes.
+ * @param[out] network_addr_list_p - IP network addresses of the returned routes.
+ * @param[in,out] route_cnt_p      - [in] number of routes to get. max 4096;
+ *                                   [out] number of routes returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if parameters exceed range.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if ecmp_id not found.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_ecmp_uc_route_iter_get(const sx_api_handle_t handle,
+                                                 const sx_access_cmd_t cmd,
+                                                 const sx_ecmp_id_t    ecmp_id,
+                                                 const sx_router_id_t  vrid_key,
+                                                 const sx_ip_prefix_t *network_addr_key_p,
+                                                 sx_router_id_t       *vrid_list_p,
+                                                 sx_ip_prefix_t       *network_addr_list_p,
+                                                 uint32_t             *route_cnt_p);
+
+/**
+ *  This API returns the ECMP containers that hold a given next hop.
+ *  If *ecmp_cnt_p is 0, only the number of such containers is returned.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle           - SX-API handle.
+ * @param[in] next_hop_key_p   - next hop key.
+ * @param[out] ecmp_list_p     - list of ECMP container IDs.
+ * @param[in,out] ecmp_cnt_p   - [in] size of ecmp_list_p;
+ *                               [out] number of ECMP container IDs returned.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_next_hop_ecmp_get(const sx_api_handle_t    handle,
+                                            const sx_next_hop_key_t *next_hop_key_p,
+                                            sx_ecmp_id_t            *ecmp_list_p,
+                                            uint32_t                *ecmp_cnt_p);
+
+/**
+ *  This API replaces a next hop by another next hop in every ECMP container
+ *  that holds it, in one API call.
+ *  Routes keep pointing to the same ECMP containers and are not rewritten, so
+ *  the cost of this API depends on the number of containers that hold the next
+ *  hop and not on the number of routes that use them.
+ *  If new_next_hop_p is already in a container, the old next hop is deleted from
+ *  that container instead. In ECMP containers of type SX_ECMP_TYPE_RESILIENT_E,
+ *  only the buckets of the old next hop are changed.
+ *  Redirected containers are updated as well. ECMP NVE containers are skipped.
+ *  The call is all-or-nothing across containers: the SDK first reserves the
+ *  resources needed to update every container, and if any container cannot be
+ *  updated, no container is changed, the error is returned and *ecmp_cnt_p is 0.
+ *  On success, *ecmp_cnt_p holds the number of containers updated.
+ *
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle             - SX-API handle.
+ * @param[in] old_next_hop_key_p - key of the next hop to replace.
+ * @param[in] new_next_hop_p     - next hop to put in its place (key, weight, action).
+ * @param[out] ecmp_cnt_p        - number of ECMP containers updated.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if a parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if any input parameter is invalid.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if no ECMP container holds the old next hop.
+ * @return SX_STATUS_NO_RESOURCES if there are no resources to update a container.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_next_hop_replace_set(const sx_api_handle_t    handle,
+                                               const sx_next_hop_key_t *old_next_hop_key_p,
+                                               const sx_next_hop_t     *new_next_hop_p,
+                                               uint32_t                *ecmp_cnt_p);
+
 
 /**
  *
@@ -1754,4 +2770,74 @@ sx_status_t sx_api_router_ecmp_redirect_get(const sx_api_handle_t handle,
 sx_status_t sx_api_router_req_completion_info_get(const sx_api_handle_t                      handle,
                                                   sx_router_req_completion_info_get_entry_t* completion_info_p);
 
+/**
+ *  This API creates/destroys a per-handle completion queue for Async route requests.
+ *  While the queue exists, one entry is posted to it for every route request that
+ *  returned SX_STATUS_ACCEPTED, once the request is completed in Hardware. The entry
+ *  holds the user cookie given with the route, the final status of the request, and
+ *  the time at which the route was committed to Hardware.
+ *  The queue is a ring of queue_size entries in memory shared between the SDK and
+ *  the caller, so entries are read by sx_api_router_req_completion_queue_get()
+ *  without a call to the SDK. The returned file descriptor becomes readable while
+ *  the queue is not empty, and may be used with poll/select/epoll.
+ *  Entries are never overwritten or dropped. Every Async route request accepted
+ *  while the queue exists reserves one entry in the ring until that entry is read.
+ *  When all queue_size entries are reserved, new Async route requests of the handle
+ *  are rejected with SX_STATUS_NO_RESOURCES (per entry in status_list_p for bulk
+ *  APIs) until the caller reads entries from the queue.
+ *  sx_api_router_req_completion_info_get() keeps working while the queue exists.
+ *   Note: This API is relevant if the Router has been initialized in Async mode only.
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle     - SX-API handle.
+ * @param[in] cmd        - CREATE/DESTROY.
+ * @param[in] queue_size - number of entries in the ring. Ignored for DESTROY.
+ * @param[in,out] fd_p   - file descriptor of the queue. Returned on CREATE,
+ *                         given by the caller on DESTROY.
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_CMD_UNSUPPORTED if access command isn't supported.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_EXCEEDS_RANGE if queue_size exceeds range.
+ * @return SX_STATUS_ALREADY_INITIALIZED if a queue already exists for the handle.
+ * @return SX_STATUS_NO_MEMORY if the ring cannot be allocated.
+ * @return SX_STATUS_ENTRY_NOT_FOUND if no queue exists on DESTROY.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_req_completion_queue_set(const sx_api_handle_t handle,
+                                                   const sx_access_cmd_t cmd,
+                                                   const uint32_t        queue_size,
+                                                   sx_fd_t              *fd_p);
+
+/**
+ *  This API reads completed route requests from a completion queue created by
+ *  sx_api_router_req_completion_queue_set(). Entries are returned in the order
+ *  in which the requests completed in Hardware, and are removed from the queue.
+ *  Entry i is returned in completion_info_list_p[i], which holds the user cookie of the
+ *  request as returned by sx_api_router_req_completion_info_get(), in status_list_p[i],
+ *  the final status of the request, and in commit_time_list_p[i], the time at which
+ *  the route was committed to Hardware, in nanoseconds of CLOCK_MONOTONIC.
+ *  This API does not block. If the queue is empty, *entry_cnt_p is set to 0.
+ *   Note: This API is relevant if the Router has been initialized in Async mode only.
+ *  Supported devices: Spectrum, Spectrum2, Spectrum3.
+ *
+ * @param[in] handle                  - SX-API handle.
+ * @param[in] fd_p                    - file descriptor of the queue
+ * @param[out] completion_info_list_p - completion info of each request
+ * @param[out] status_list_p          - final status of each request
+ * @param[out] commit_time_list_p     - Hardware commit time of each request
+ * @param[in,out] entry_cnt_p         - [in] size of the lists; [out] number of entries read
+ *
+ * @return SX_STATUS_SUCCESS if operation completes successfully.
+ * @return SX_STATUS_PARAM_NULL if parameter is NULL.
+ * @return SX_STATUS_PARAM_ERROR if fd_p is not a completion queue of the handle.
+ * @return SX_STATUS_ERROR general error.
+ */
+sx_status_t sx_api_router_req_completion_queue_get(const sx_api_handle_t                      handle,
+                                                   const sx_fd_t                             *fd_p,
+                                                   sx_router_req_completion_info_get_entry_t *completion_info_list_p,
+                                                   sx_status_t                               *status_list_p,
+                                                   uint64_t                                  *commit_time_list_p,
+                                                   uint32_t                                  *entry_cnt_p);
+
 #endif /* __SX_API_ROUTER_H__ */